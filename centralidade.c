@@ -0,0 +1,564 @@
+// PageRank e centralidades (grau e proximidade) sobre a lista de adjacência.
+//
+// O PageRank não percorre as listas encadeadas a cada iteração: a lista é
+// convertida uma única vez em uma matriz esparsa transposta (quem aponta para
+// cada vértice), dividida em blocos de vértices de origem. Cada bloco só lê uma
+// faixa do array de contribuições, que assim cabe na cache. A iteração é do tipo
+// "pull": cada vértice soma as contribuições de quem aponta para ele, então cada
+// thread escreve apenas nos seus próprios vértices e não precisa de atômicos.
+//
+// Compilar com: gcc -O2 -fopenmp centralidade.c -o centralidade -lm
+// (sem -fopenmp o código roda em uma única thread)
+
+#define _POSIX_C_SOURCE 199309L // clock_gettime e CLOCK_MONOTONIC
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#ifdef _OPENMP
+#include <omp.h>
+// Diretiva OpenMP que some quando o código é compilado sem -fopenmp
+#define OMP(...) _Pragma(#__VA_ARGS__)
+#else
+#define OMP(...)
+#endif
+
+#define TAM_BLOCO_PADRAO 32768 // Vértices de origem por bloco (256 KB de contribuições)
+
+// Estrutura para um nó da lista de adjacência
+typedef struct No {
+    int vertice;
+    int peso;
+    struct No* proximo;
+} No;
+
+// Estrutura para o grafo
+typedef struct {
+    int num_vertices;
+    bool direcionado;
+    No** lista_adj; // Array de ponteiros para No
+} Grafo;
+
+// Arestas que chegam a cada vértice vindas de uma faixa de vértices de origem
+typedef struct {
+    int inicio;          // Primeiro vértice de origem do bloco
+    int fim;             // Um após o último vértice de origem do bloco
+    int num_destinos;    // Vértices que recebem pelo menos uma aresta do bloco
+    int* destinos;       // Em ordem crescente
+    int32_t* deslocamentos; // Origens de destinos[i] em origens[deslocamentos[i] .. deslocamentos[i + 1] - 1]
+    int* origens;
+} BlocoTransposto;
+
+// Matriz de adjacência transposta, esparsa e dividida em blocos de origem
+typedef struct {
+    int num_vertices;
+    int64_t num_arestas;
+    int* grau_saida;
+    int* grau_entrada;
+    int num_blocos;
+    BlocoTransposto* blocos;
+} Transposta;
+
+// Cria um novo nó
+No* criar_no(int vertice, int peso) {
+    No* novo_no = (No*)malloc(sizeof(No));
+    if (novo_no == NULL) {
+        perror("Erro ao alocar memória para o nó");
+        exit(EXIT_FAILURE);
+    }
+    novo_no->vertice = vertice;
+    novo_no->peso = peso;
+    novo_no->proximo = NULL;
+    return novo_no;
+}
+
+// Inicializa um grafo
+Grafo* criar_grafo(int num_vertices, bool direcionado) {
+    Grafo* g = (Grafo*)malloc(sizeof(Grafo));
+    if (g == NULL) {
+        perror("Erro ao alocar memória para o grafo");
+        exit(EXIT_FAILURE);
+    }
+    g->num_vertices = num_vertices;
+    g->direcionado = direcionado;
+    g->lista_adj = (No**)malloc(num_vertices * sizeof(No*));
+    if (g->lista_adj == NULL) {
+        perror("Erro ao alocar memória para as listas de adjacência");
+        free(g);
+        exit(EXIT_FAILURE);
+    }
+
+    for (int i = 0; i < num_vertices; i++) {
+        g->lista_adj[i] = NULL;
+    }
+
+    return g;
+}
+
+// Adiciona uma aresta entre v1 e v2 com peso opcional
+void adicionar_aresta(Grafo* g, int v1, int v2, int peso) {
+    if (v1 >= 0 && v1 < g->num_vertices && v2 >= 0 && v2 < g->num_vertices) {
+        // Adiciona v2 na lista de v1
+        No* novo_no = criar_no(v2, peso);
+        novo_no->proximo = g->lista_adj[v1];
+        g->lista_adj[v1] = novo_no;
+
+        // Se não for direcionado, adiciona v1 na lista de v2
+        if (!g->direcionado) {
+            novo_no = criar_no(v1, peso);
+            novo_no->proximo = g->lista_adj[v2];
+            g->lista_adj[v2] = novo_no;
+        }
+    }
+}
+
+// Libera a memória alocada para o grafo
+void destruir_grafo(Grafo* g) {
+    for (int i = 0; i < g->num_vertices; i++) {
+        No* atual = g->lista_adj[i];
+        while (atual != NULL) {
+            No* temp = atual;
+            atual = atual->proximo;
+            free(temp);
+        }
+    }
+    free(g->lista_adj);
+    free(g);
+}
+
+// Compara dois inteiros (para o qsort)
+int comparar_inteiros(const void* a, const void* b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Monta a transposta do grafo em blocos de até tam_bloco vértices de origem.
+// Os deslocamentos são relativos ao bloco e têm 32 bits; um bloco termina antes
+// de tam_bloco vértices se suas arestas passarem de INT32_MAX.
+Transposta* criar_transposta(Grafo* g, int tam_bloco) {
+    int n = g->num_vertices;
+    Transposta* t = (Transposta*)malloc(sizeof(Transposta));
+    int* contador = (int*)calloc(n, sizeof(int));
+    int* tocados = (int*)malloc(n * sizeof(int)); // Destinos distintos do bloco atual
+    if (t == NULL || contador == NULL || (n > 0 && tocados == NULL)) {
+        perror("Erro ao alocar memória para a transposta");
+        exit(EXIT_FAILURE);
+    }
+    t->num_vertices = n;
+    t->num_arestas = 0;
+    t->grau_saida = (int*)calloc(n, sizeof(int));
+    t->grau_entrada = (int*)calloc(n, sizeof(int));
+    int capacidade = (int)(((int64_t)n + tam_bloco - 1) / tam_bloco) + 1;
+    t->num_blocos = 0;
+    t->blocos = (BlocoTransposto*)malloc(capacidade * sizeof(BlocoTransposto));
+    if (t->grau_saida == NULL || t->grau_entrada == NULL || t->blocos == NULL) {
+        perror("Erro ao alocar memória para a transposta");
+        exit(EXIT_FAILURE);
+    }
+
+    // O grau de saída define onde cada bloco termina
+    for (int u = 0; u < n; u++) {
+        for (No* atual = g->lista_adj[u]; atual != NULL; atual = atual->proximo) {
+            t->grau_saida[u]++;
+        }
+    }
+
+    for (int inicio = 0; inicio < n; inicio = t->blocos[t->num_blocos - 1].fim) {
+        if (t->num_blocos == capacidade) {
+            capacidade *= 2;
+            BlocoTransposto* blocos = (BlocoTransposto*)realloc(t->blocos, capacidade * sizeof(BlocoTransposto));
+            if (blocos == NULL) {
+                perror("Erro ao alocar memória para a transposta");
+                exit(EXIT_FAILURE);
+            }
+            t->blocos = blocos;
+        }
+        BlocoTransposto* bloco = &t->blocos[t->num_blocos++];
+        bloco->inicio = inicio;
+        bloco->fim = inicio;
+        int64_t arestas_bloco = 0;
+        while (bloco->fim < n && bloco->fim - inicio < tam_bloco &&
+               arestas_bloco + t->grau_saida[bloco->fim] <= INT32_MAX) {
+            arestas_bloco += t->grau_saida[bloco->fim++];
+        }
+
+        // Conta quantas arestas do bloco chegam a cada vértice, guardando os destinos distintos
+        bloco->num_destinos = 0;
+        for (int u = bloco->inicio; u < bloco->fim; u++) {
+            for (No* atual = g->lista_adj[u]; atual != NULL; atual = atual->proximo) {
+                if (contador[atual->vertice]++ == 0) {
+                    tocados[bloco->num_destinos++] = atual->vertice;
+                }
+            }
+        }
+        // Destinos em ordem crescente deixam as escritas em soma sequenciais. Se o bloco
+        // atinge boa parte dos vértices, percorrer contador em ordem sai mais barato que
+        // ordenar, e o custo continua proporcional ao número de destinos.
+        if ((int64_t)bloco->num_destinos * 16 >= n) {
+            int d = 0;
+            for (int v = 0; v < n; v++) {
+                if (contador[v] > 0) tocados[d++] = v;
+            }
+        } else {
+            qsort(tocados, bloco->num_destinos, sizeof(int), comparar_inteiros);
+        }
+
+        bloco->destinos = (int*)malloc(bloco->num_destinos * sizeof(int));
+        bloco->deslocamentos = (int32_t*)malloc((bloco->num_destinos + 1) * sizeof(int32_t));
+        bloco->origens = (int*)malloc(arestas_bloco * sizeof(int));
+        if ((bloco->num_destinos > 0 && bloco->destinos == NULL) || bloco->deslocamentos == NULL || (arestas_bloco > 0 && bloco->origens == NULL)) {
+            perror("Erro ao alocar memória para o bloco da transposta");
+            exit(EXIT_FAILURE);
+        }
+
+        // Define a posição de cada destino; contador passa a guardar o índice do destino
+        int32_t deslocamento = 0;
+        for (int i = 0; i < bloco->num_destinos; i++) {
+            int v = tocados[i];
+            t->grau_entrada[v] += contador[v];
+            bloco->destinos[i] = v;
+            bloco->deslocamentos[i] = deslocamento;
+            deslocamento += contador[v];
+            contador[v] = i;
+        }
+        bloco->deslocamentos[bloco->num_destinos] = deslocamento;
+
+        // Preenche as origens; deslocamentos[i] avança como cursor e é restaurado depois
+        for (int u = bloco->inicio; u < bloco->fim; u++) {
+            for (No* atual = g->lista_adj[u]; atual != NULL; atual = atual->proximo) {
+                bloco->origens[bloco->deslocamentos[contador[atual->vertice]]++] = u;
+            }
+        }
+        for (int j = bloco->num_destinos; j > 0; j--) {
+            bloco->deslocamentos[j] = bloco->deslocamentos[j - 1];
+        }
+        bloco->deslocamentos[0] = 0;
+
+        for (int j = 0; j < bloco->num_destinos; j++) {
+            contador[bloco->destinos[j]] = 0;
+        }
+        t->num_arestas += arestas_bloco;
+    }
+
+    free(contador);
+    free(tocados);
+    return t;
+}
+
+// Libera a memória da transposta
+void destruir_transposta(Transposta* t) {
+    for (int b = 0; b < t->num_blocos; b++) {
+        free(t->blocos[b].destinos);
+        free(t->blocos[b].deslocamentos);
+        free(t->blocos[b].origens);
+    }
+    free(t->blocos);
+    free(t->grau_saida);
+    free(t->grau_entrada);
+    free(t);
+}
+
+// Calcula o PageRank com o kernel "pull" em blocos.
+// Para quando a soma das variações (norma L1) fica abaixo da tolerância ou
+// quando atinge max_iteracoes. Vértices sem arestas de saída distribuem seu
+// valor igualmente entre todos. Retorna o número de iterações executadas.
+int pagerank(Transposta* t, double amortecimento, double tolerancia, int max_iteracoes, double* rank) {
+    int n = t->num_vertices;
+    if (n == 0) return 0;
+    double* contribuicao = (double*)malloc(n * sizeof(double));
+    double* soma = (double*)malloc(n * sizeof(double));
+    if (contribuicao == NULL || soma == NULL) {
+        perror("Erro ao alocar memória para o PageRank");
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < n; v++) {
+        rank[v] = 1.0 / n;
+    }
+
+    int iteracao = 0;
+    while (iteracao < max_iteracoes) {
+        iteracao++;
+
+        // Pré-calcula a contribuição de cada vértice e o valor dos vértices sem saída
+        double sem_saida = 0.0;
+        OMP(omp parallel for reduction(+:sem_saida))
+        for (int v = 0; v < n; v++) {
+            if (t->grau_saida[v] > 0) {
+                contribuicao[v] = rank[v] / t->grau_saida[v];
+            } else {
+                contribuicao[v] = 0.0;
+                sem_saida += rank[v];
+            }
+            soma[v] = 0.0;
+        }
+
+        // Cada destino aparece uma vez por bloco, então cada thread escreve só nos seus
+        OMP(omp parallel)
+        for (int b = 0; b < t->num_blocos; b++) {
+            BlocoTransposto* bloco = &t->blocos[b];
+            OMP(omp for schedule(dynamic, 1024))
+            for (int i = 0; i < bloco->num_destinos; i++) {
+                double acumulado = 0.0;
+                for (int32_t k = bloco->deslocamentos[i]; k < bloco->deslocamentos[i + 1]; k++) {
+                    acumulado += contribuicao[bloco->origens[k]];
+                }
+                soma[bloco->destinos[i]] += acumulado;
+            }
+        }
+
+        double base = (1.0 - amortecimento) / n + amortecimento * sem_saida / n;
+        double variacao = 0.0;
+        OMP(omp parallel for reduction(+:variacao))
+        for (int v = 0; v < n; v++) {
+            double novo = base + amortecimento * soma[v];
+            variacao += fabs(novo - rank[v]);
+            rank[v] = novo;
+        }
+        if (variacao < tolerancia) break;
+    }
+
+    free(contribuicao);
+    free(soma);
+    return iteracao;
+}
+
+// PageRank direto nas listas encadeadas ("push"), usado como referência
+int pagerank_lista(Grafo* g, double amortecimento, double tolerancia, int max_iteracoes, double* rank) {
+    int n = g->num_vertices;
+    if (n == 0) return 0;
+    int* grau_saida = (int*)calloc(n, sizeof(int));
+    double* novo = (double*)malloc(n * sizeof(double));
+    if (grau_saida == NULL || novo == NULL) {
+        perror("Erro ao alocar memória para o PageRank");
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < n; v++) {
+        for (No* atual = g->lista_adj[v]; atual != NULL; atual = atual->proximo) {
+            grau_saida[v]++;
+        }
+        rank[v] = 1.0 / n;
+    }
+
+    int iteracao = 0;
+    while (iteracao < max_iteracoes) {
+        iteracao++;
+        double sem_saida = 0.0;
+        for (int v = 0; v < n; v++) {
+            novo[v] = 0.0;
+            if (grau_saida[v] == 0) sem_saida += rank[v];
+        }
+        for (int u = 0; u < n; u++) {
+            for (No* atual = g->lista_adj[u]; atual != NULL; atual = atual->proximo) {
+                novo[atual->vertice] += rank[u] / grau_saida[u];
+            }
+        }
+        double base = (1.0 - amortecimento) / n + amortecimento * sem_saida / n;
+        double variacao = 0.0;
+        for (int v = 0; v < n; v++) {
+            double valor = base + amortecimento * novo[v];
+            variacao += fabs(valor - rank[v]);
+            rank[v] = valor;
+        }
+        if (variacao < tolerancia) break;
+    }
+
+    free(grau_saida);
+    free(novo);
+    return iteracao;
+}
+
+// Centralidade de grau (entrada e saída), normalizada por n - 1
+void centralidade_grau(Transposta* t, double* entrada, double* saida) {
+    int n = t->num_vertices;
+    double normalizacao = n > 1 ? 1.0 / (n - 1) : 1.0;
+    for (int v = 0; v < n; v++) {
+        entrada[v] = t->grau_entrada[v] * normalizacao;
+        saida[v] = t->grau_saida[v] * normalizacao;
+    }
+}
+
+// Centralidade de proximidade (closeness) sem pesos, com uma BFS por vértice.
+// Em grafos desconexos usa a correção de Wasserman e Faust: o valor é escalado
+// pela fração de vértices alcançados a partir de v.
+void centralidade_proximidade(Grafo* g, double* proximidade) {
+    int n = g->num_vertices;
+
+    OMP(omp parallel)
+    {
+        // Cada thread tem sua própria fila e distâncias
+        int* distancia = (int*)malloc(n * sizeof(int));
+        int* fila = (int*)malloc(n * sizeof(int));
+        if (distancia == NULL || fila == NULL) {
+            perror("Erro ao alocar memória para a BFS");
+            exit(EXIT_FAILURE);
+        }
+
+        OMP(omp for schedule(dynamic, 16))
+        for (int origem = 0; origem < n; origem++) {
+            for (int v = 0; v < n; v++) {
+                distancia[v] = -1;
+            }
+            int frente = 0, tras = 0;
+            distancia[origem] = 0;
+            fila[tras++] = origem;
+            int64_t soma_distancias = 0;
+            while (frente < tras) {
+                int u = fila[frente++];
+                soma_distancias += distancia[u];
+                for (No* atual = g->lista_adj[u]; atual != NULL; atual = atual->proximo) {
+                    if (distancia[atual->vertice] == -1) {
+                        distancia[atual->vertice] = distancia[u] + 1;
+                        fila[tras++] = atual->vertice;
+                    }
+                }
+            }
+            int alcancados = tras - 1;
+            if (alcancados == 0 || soma_distancias == 0) {
+                proximidade[origem] = 0.0;
+            } else {
+                proximidade[origem] = ((double)alcancados / soma_distancias) * ((double)alcancados / (n - 1));
+            }
+        }
+
+        free(distancia);
+        free(fila);
+    }
+}
+
+// Gerador pseudoaleatório simples (xorshift), independente do RAND_MAX da plataforma
+uint64_t proximo_aleatorio(uint64_t* estado) {
+    *estado ^= *estado << 13;
+    *estado ^= *estado >> 7;
+    *estado ^= *estado << 17;
+    return *estado;
+}
+
+// Gera um grafo direcionado aleatório com num_arestas arestas.
+// Os destinos são sorteados de forma enviesada (quadrado de um uniforme), para
+// que alguns vértices concentrem muitas arestas de entrada, como em grafos reais.
+Grafo* gerar_grafo_aleatorio(int num_vertices, int64_t num_arestas, uint64_t semente) {
+    Grafo* g = criar_grafo(num_vertices, true);
+    uint64_t estado = semente ? semente : 88172645463325252ULL;
+    for (int64_t i = 0; i < num_arestas; i++) {
+        int v1 = (int)(proximo_aleatorio(&estado) % num_vertices);
+        double x = (double)(proximo_aleatorio(&estado) >> 11) / (double)(1ULL << 53);
+        int v2 = (int)(x * x * num_vertices);
+        adicionar_aresta(g, v1, v2, 1);
+    }
+    return g;
+}
+
+// Tempo atual em segundos
+double agora() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Compara o kernel em blocos com o PageRank direto nas listas
+void benchmark(int num_vertices, int64_t num_arestas, int tam_bloco) {
+    double amortecimento = 0.85, tolerancia = 1e-9;
+    int max_iteracoes = 100;
+
+    printf("\nBenchmark: %d vertices, %lld arestas, blocos de %d vertices", num_vertices,
+           (long long)num_arestas, tam_bloco);
+#ifdef _OPENMP
+    printf(", %d threads", omp_get_max_threads());
+#endif
+    printf("\n");
+
+    double inicio = agora();
+    Grafo* g = gerar_grafo_aleatorio(num_vertices, num_arestas, 42);
+    printf("Geracao do grafo: %.3f s\n", agora() - inicio);
+
+    double* rank_lista = (double*)malloc(num_vertices * sizeof(double));
+    double* rank = (double*)malloc(num_vertices * sizeof(double));
+    if (rank_lista == NULL || rank == NULL) {
+        perror("Erro ao alocar memória para o benchmark");
+        exit(EXIT_FAILURE);
+    }
+
+    inicio = agora();
+    int iteracoes_lista = pagerank_lista(g, amortecimento, tolerancia, max_iteracoes, rank_lista);
+    double tempo_lista = agora() - inicio;
+    printf("Listas encadeadas: %d iteracoes em %.3f s (%.2f ms/iteracao)\n", iteracoes_lista,
+           tempo_lista, 1000.0 * tempo_lista / iteracoes_lista);
+
+    inicio = agora();
+    Transposta* t = criar_transposta(g, tam_bloco);
+    printf("Montagem da transposta: %.3f s\n", agora() - inicio);
+
+    inicio = agora();
+    int iteracoes = pagerank(t, amortecimento, tolerancia, max_iteracoes, rank);
+    double tempo = agora() - inicio;
+    printf("Kernel em blocos: %d iteracoes em %.3f s (%.2f ms/iteracao)\n", iteracoes, tempo,
+           1000.0 * tempo / iteracoes);
+
+    double diferenca = 0.0;
+    for (int v = 0; v < num_vertices; v++) {
+        diferenca = fmax(diferenca, fabs(rank[v] - rank_lista[v]));
+    }
+    printf("Maior diferenca entre os resultados: %.3e\n", diferenca);
+
+    free(rank_lista);
+    free(rank);
+    destruir_transposta(t);
+    destruir_grafo(g);
+}
+
+// Exemplo de uso:
+//   ./centralidade                                        (grafo de exemplo)
+//   ./centralidade num_vertices num_arestas [tam_bloco]   (benchmark com grafo gerado)
+int main(int argc, char* argv[]) {
+    if (argc >= 3) {
+        int num_vertices = atoi(argv[1]);
+        int64_t num_arestas = atoll(argv[2]);
+        int tam_bloco = argc >= 4 ? atoi(argv[3]) : TAM_BLOCO_PADRAO;
+        if (num_vertices <= 0 || num_arestas < 0 || tam_bloco <= 0) {
+            printf("Parametros invalidos!\n");
+            return 1;
+        }
+        if (tam_bloco > num_vertices) {
+            tam_bloco = num_vertices;
+        }
+        benchmark(num_vertices, num_arestas, tam_bloco);
+        return 0;
+    }
+
+    int num_vertices = 5;
+    bool direcionado = true;
+
+    Grafo* g = criar_grafo(num_vertices, direcionado);
+
+    // Adicionando arestas
+    adicionar_aresta(g, 0, 1, 1);
+    adicionar_aresta(g, 0, 2, 1);
+    adicionar_aresta(g, 1, 2, 1);
+    adicionar_aresta(g, 2, 0, 1);
+    adicionar_aresta(g, 3, 2, 1);
+    adicionar_aresta(g, 4, 3, 1);
+
+    // Blocos de 2 vértices apenas para exercitar a divisão em blocos
+    Transposta* t = criar_transposta(g, 2);
+
+    double rank[5], entrada[5], saida[5], proximidade[5];
+    int iteracoes = pagerank(t, 0.85, 1e-10, 100, rank);
+    centralidade_grau(t, entrada, saida);
+    centralidade_proximidade(g, proximidade);
+
+    printf("PageRank convergiu em %d iteracoes\n", iteracoes);
+    printf("Vertice  PageRank  Grau(ent)  Grau(sai)  Proximidade\n");
+    for (int v = 0; v < num_vertices; v++) {
+        printf("%7d  %8.4f  %9.2f  %9.2f  %11.4f\n", v, rank[v], entrada[v], saida[v], proximidade[v]);
+    }
+
+    // Liberando memória
+    destruir_transposta(t);
+    destruir_grafo(g);
+
+    return 0;
+}
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 // Estrutura para um nó da lista de adjacência
 typedef struct No {
@@ -9,6 +10,12 @@ typedef struct No {
     struct No* proximo;
 } No;
 
+// Bloco contíguo de nós alocado por uma inserção em lote
+typedef struct {
+    No* nos;
+    size_t tamanho;
+} BlocoNos;
+
 // Estrutura para o grafo
 typedef struct {
     int num_vertices;
@@ -18,8 +25,24 @@ typedef struct {
     int* anterior;  // Array para armazenar o caminho (pai no DFS tree)
     bool* na_pilha; // Array para marcar vértices na pilha de recursão (em processo)
     int* ciclo;     // Array para armazenar o ciclo
+    BlocoNos* blocos; // Blocos de nós criados pela inserção em lote
+    int num_blocos;   // Quantidade de blocos em uso
 } Grafo;
 
+// Aresta de entrada para a inserção em lote
+typedef struct {
+    int v1;
+    int v2;
+    int peso;
+} Aresta;
+
+// Política para arestas repetidas dentro de um mesmo lote
+typedef enum {
+    MANTER_MENOR,  // Mantém o menor peso
+    MANTER_MAIOR,  // Mantém o maior peso
+    MANTER_ULTIMO  // Mantém o peso da última ocorrência no lote
+} PoliticaDuplicata;
+
 // Cria um novo nó
 No* criar_no(int vertice, int peso) {
     No* novo_no = (No*)malloc(sizeof(No));
@@ -70,6 +93,8 @@ Grafo* criar_grafo(int num_vertices, bool direcionado) {
         g->na_pilha[i] = false;
         g->anterior[i] = -1; // Inicializa com -1
     }
+    g->blocos = NULL;
+    g->num_blocos = 0;
     
     return g;
 }
@@ -94,6 +119,155 @@ void adicionar_aresta(Grafo* g, int v1, int v2, int peso) {
     }
 }
 
+// Aresta do lote junto com sua posição original, usada para desempatar a ordenação
+typedef struct {
+    int v1;
+    int v2;
+    int peso;
+    int ordem;
+} ArestaLote;
+
+// Ordena por (v1, v2) e, em caso de empate, pela ordem de chegada no lote
+int comparar_arestas_lote(const void* a, const void* b) {
+    const ArestaLote* x = (const ArestaLote*)a;
+    const ArestaLote* y = (const ArestaLote*)b;
+    if (x->v1 != y->v1) return (x->v1 > y->v1) - (x->v1 < y->v1);
+    if (x->v2 != y->v2) return (x->v2 > y->v2) - (x->v2 < y->v2);
+    return (x->ordem > y->ordem) - (x->ordem < y->ordem);
+}
+
+// Adiciona um lote de arestas de uma só vez.
+// Arestas fora dos limites são descartadas com um único aviso, arestas repetidas
+// no lote viram uma só (com o peso escolhido pela política) e os nós de todos os
+// vértices são alocados em um único bloco, dimensionado pela contagem de graus.
+// Retorna o número de arestas distintas inseridas.
+int adicionar_arestas_lote(Grafo* g, const Aresta* arestas, int num_arestas, PoliticaDuplicata politica) {
+    if (num_arestas <= 0) return 0;
+
+    ArestaLote* lote = (ArestaLote*)malloc(num_arestas * sizeof(ArestaLote));
+    if (lote == NULL) {
+        perror("Erro ao alocar memória para o lote de arestas");
+        exit(EXIT_FAILURE);
+    }
+
+    // Valida tudo em uma passada. Em grafos não direcionados a aresta é guardada
+    // como (menor, maior), para que (u, v) e (v, u) sejam reconhecidas como iguais.
+    int validas = 0;
+    int invalidas = 0;
+    for (int i = 0; i < num_arestas; i++) {
+        int v1 = arestas[i].v1;
+        int v2 = arestas[i].v2;
+        if (v1 < 0 || v1 >= g->num_vertices || v2 < 0 || v2 >= g->num_vertices) {
+            invalidas++;
+            continue;
+        }
+        if (!g->direcionado && v1 > v2) {
+            int temp = v1;
+            v1 = v2;
+            v2 = temp;
+        }
+        lote[validas].v1 = v1;
+        lote[validas].v2 = v2;
+        lote[validas].peso = arestas[i].peso;
+        lote[validas].ordem = i;
+        validas++;
+    }
+    if (invalidas > 0) {
+        fprintf(stderr, "Aviso: %d aresta(s) fora dos limites do grafo descartada(s).\n", invalidas);
+    }
+    if (validas == 0) {
+        free(lote);
+        return 0;
+    }
+
+    qsort(lote, validas, sizeof(ArestaLote), comparar_arestas_lote);
+
+    // Remove as duplicatas: como o lote está ordenado, as repetições ficam vizinhas
+    int distintas = 0;
+    for (int i = 0; i < validas; i++) {
+        ArestaLote* ultima = distintas > 0 ? &lote[distintas - 1] : NULL;
+        if (ultima == NULL || ultima->v1 != lote[i].v1 || ultima->v2 != lote[i].v2) {
+            lote[distintas++] = lote[i];
+            continue;
+        }
+        switch (politica) {
+            case MANTER_MENOR:
+                if (lote[i].peso < ultima->peso) ultima->peso = lote[i].peso;
+                break;
+            case MANTER_MAIOR:
+                if (lote[i].peso > ultima->peso) ultima->peso = lote[i].peso;
+                break;
+            case MANTER_ULTIMO:
+                ultima->peso = lote[i].peso; // Empates já estão em ordem de chegada
+                break;
+        }
+    }
+
+    // Conta o grau de cada vértice; inicio[v] passa a ser a posição de v no bloco
+    size_t* inicio = (size_t*)calloc(g->num_vertices + 1, sizeof(size_t));
+    size_t* cursor = (size_t*)malloc(g->num_vertices * sizeof(size_t));
+    if (inicio == NULL || cursor == NULL) {
+        perror("Erro ao alocar memória para a contagem de graus");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < distintas; i++) {
+        inicio[lote[i].v1 + 1]++;
+        if (!g->direcionado && lote[i].v1 != lote[i].v2) {
+            inicio[lote[i].v2 + 1]++;
+        }
+    }
+    for (int v = 0; v < g->num_vertices; v++) {
+        inicio[v + 1] += inicio[v];
+        cursor[v] = inicio[v];
+    }
+    size_t total = inicio[g->num_vertices];
+
+    No* bloco = (No*)malloc(total * sizeof(No));
+    BlocoNos* blocos = (BlocoNos*)realloc(g->blocos, (g->num_blocos + 1) * sizeof(BlocoNos));
+    if (bloco == NULL || blocos == NULL) {
+        perror("Erro ao alocar memória para o bloco de nós");
+        exit(EXIT_FAILURE);
+    }
+    g->blocos = blocos;
+
+    // Mantém os blocos ordenados por endereço para a busca binária em no_em_bloco
+    int pos = g->num_blocos;
+    while (pos > 0 && (uintptr_t)g->blocos[pos - 1].nos > (uintptr_t)bloco) {
+        g->blocos[pos] = g->blocos[pos - 1];
+        pos--;
+    }
+    g->blocos[pos].nos = bloco;
+    g->blocos[pos].tamanho = total;
+    g->num_blocos++;
+
+    // Preenche o bloco em uma única varredura, espelhando as arestas se não for direcionado
+    for (int i = 0; i < distintas; i++) {
+        No* no = &bloco[cursor[lote[i].v1]++];
+        no->vertice = lote[i].v2;
+        no->peso = lote[i].peso;
+        if (!g->direcionado && lote[i].v1 != lote[i].v2) {
+            no = &bloco[cursor[lote[i].v2]++];
+            no->vertice = lote[i].v1;
+            no->peso = lote[i].peso;
+        }
+    }
+
+    // Encadeia os nós de cada vértice na frente da lista que ele já possuía
+    for (int v = 0; v < g->num_vertices; v++) {
+        if (inicio[v] == inicio[v + 1]) continue;
+        for (size_t k = inicio[v]; k + 1 < inicio[v + 1]; k++) {
+            bloco[k].proximo = &bloco[k + 1];
+        }
+        bloco[inicio[v + 1] - 1].proximo = g->lista_adj[v];
+        g->lista_adj[v] = &bloco[inicio[v]];
+    }
+
+    free(inicio);
+    free(cursor);
+    free(lote);
+    return distintas;
+}
+
 // Função auxiliar para reconstruir e imprimir o ciclo
 void reconstruir_e_imprimir_ciclo(Grafo* g, int vertice_atual, int vertice_ciclo_start) {
     int ciclo_pos = 0;
@@ -176,6 +350,27 @@ void imprimir_grafo(Grafo* g) {
     }
 }
 
+// Verifica se o nó pertence a um bloco da inserção em lote (e não foi alocado sozinho)
+bool no_em_bloco(Grafo* g, No* no) {
+    // Busca binária pelo último bloco que começa antes (ou no) endereço do nó
+    uintptr_t endereco = (uintptr_t)no;
+    int esq = 0;
+    int dir = g->num_blocos - 1;
+    int candidato = -1;
+    while (esq <= dir) {
+        int meio = (esq + dir) / 2;
+        if ((uintptr_t)g->blocos[meio].nos <= endereco) {
+            candidato = meio;
+            esq = meio + 1;
+        } else {
+            dir = meio - 1;
+        }
+    }
+    if (candidato == -1) return false;
+    uintptr_t fim = (uintptr_t)(g->blocos[candidato].nos + g->blocos[candidato].tamanho);
+    return endereco < fim;
+}
+
 // Libera a memória alocada para o grafo
 void destruir_grafo(Grafo* g) {
     if (g == NULL) return; // Evita tentar liberar NULL
@@ -185,9 +380,15 @@ void destruir_grafo(Grafo* g) {
         while (atual != NULL) {
             No* temp = atual;
             atual = atual->proximo;
-            free(temp);
+            if (!no_em_bloco(g, temp)) {
+                free(temp);
+            }
         }
     }
+    for (int i = 0; i < g->num_blocos; i++) {
+        free(g->blocos[i].nos);
+    }
+    free(g->blocos);
     free(g->lista_adj);
     free(g->visitado);
     free(g->na_pilha);
@@ -203,12 +404,19 @@ int main() {
     
     Grafo* g = criar_grafo(num_vertices, direcionado);
     
-    // Adicionando arestas
-    adicionar_aresta(g, 0, 1, 1);
-    adicionar_aresta(g, 1, 2, 1);
-    adicionar_aresta(g, 2, 3, 1);
-    adicionar_aresta(g, 3, 1, 1); // Cria um ciclo entre 1, 2, 3
-    adicionar_aresta(g, 4, 0, 1); // Aresta adicional
+    // Adicionando arestas em lote
+    Aresta arestas[] = {
+        {0, 1, 1},
+        {1, 2, 1},
+        {2, 3, 1},
+        {3, 1, 1}, // Cria um ciclo entre 1, 2, 3
+        {4, 0, 1}, // Aresta adicional
+        {1, 2, 3}, // Repetida: fica apenas uma aresta 1 -> 2
+        {4, 7, 1}  // Fora dos limites: descartada
+    };
+    int num_arestas = sizeof(arestas) / sizeof(arestas[0]);
+    int inseridas = adicionar_arestas_lote(g, arestas, num_arestas, MANTER_MENOR);
+    printf("Arestas inseridas: %d de %d\n", inseridas, num_arestas);
     
     // Imprimindo o grafo
     imprimir_grafo(g);
@@ -0,0 +1,700 @@
+// Grafo particionado em disco para grafos maiores que a memória RAM.
+//
+// O grafo é dividido em faixas de vértices (partições). Cada partição é gravada
+// em disco no formato de lista de adjacência compacta e, durante as buscas, as
+// partições passam por um conjunto limitado de buffers em memória. Uma thread
+// auxiliar carrega a próxima partição enquanto a atual é processada.
+//
+// O orçamento de memória cobre apenas os buffers. Além dele ficam em memória os
+// arrays por vértice: cerca de 6 bytes por vértice nas buscas (alcancado, ativo e
+// componente) e mais 8 bytes por vértice (grau) durante a divisão em partições.
+//
+// Compilar com: gcc grafo_particionado.c -o grafo_particionado -pthread
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define TAM_CAMINHO 512
+#define MAX_ARQUIVOS_ABERTOS 256 // Arquivos temporários abertos ao mesmo tempo na divisão das arestas
+
+// Cabeçalho gravado no início de cada arquivo de partição
+typedef struct {
+    int32_t inicio;       // Primeiro vértice da partição
+    int32_t fim;          // Um após o último vértice da partição
+    int64_t num_arestas;
+} CabecalhoParticao;
+
+// Estrutura para o grafo particionado (somente os metadados ficam em memória)
+typedef struct {
+    int num_vertices;
+    bool direcionado;
+    int num_particoes;
+    int* limites;        // Partição p contém os vértices limites[p] .. limites[p + 1] - 1
+    size_t* tamanhos;    // Tamanho em bytes do arquivo de cada partição
+    size_t tamanho_buffer; // Maior tamanho permitido para uma partição
+    char diretorio[TAM_CAMINHO / 2];
+} GrafoParticionado;
+
+typedef enum {
+    BUFFER_VAZIO,
+    BUFFER_CARREGANDO,
+    BUFFER_PRONTO
+} EstadoBuffer;
+
+// Buffer que guarda uma partição carregada do disco
+typedef struct {
+    int particao;
+    EstadoBuffer estado;
+    int fixado;              // Quantos usuários estão lendo o buffer
+    unsigned long ultimo_uso; // Para a substituição LRU
+    char* memoria;
+    // Ponteiros para dentro de memoria, válidos quando estado == BUFFER_PRONTO
+    int inicio;
+    int fim;
+    int64_t* deslocamentos; // Arestas de v em destinos[deslocamentos[v - inicio] .. deslocamentos[v - inicio + 1] - 1]
+    int32_t* destinos;
+    int32_t* pesos;
+} Buffer;
+
+// Conjunto limitado de buffers com carregamento antecipado em segundo plano
+typedef struct {
+    GrafoParticionado* g;
+    Buffer* buffers;
+    int num_buffers;
+    unsigned long relogio;
+    int pedido;     // Partição pedida para carregamento antecipado (-1 se nenhuma)
+    bool encerrar;
+    long leituras;  // Quantidade de partições lidas do disco
+    pthread_t thread;
+    pthread_mutex_t trava;
+    pthread_cond_t mudou;
+} PoolBuffers;
+
+// Monta o caminho do arquivo de uma partição (ou de seu arquivo temporário)
+void caminho_particao(GrafoParticionado* g, int p, const char* extensao, char* caminho) {
+    snprintf(caminho, TAM_CAMINHO, "%s/particao_%d.%s", g->diretorio, p, extensao);
+}
+
+// Retorna a partição que contém o vértice (busca binária nos limites)
+int particao_de(GrafoParticionado* g, int vertice) {
+    int esq = 0;
+    int dir = g->num_particoes - 1;
+    while (esq < dir) {
+        int meio = (esq + dir + 1) / 2;
+        if (g->limites[meio] <= vertice) {
+            esq = meio;
+        } else {
+            dir = meio - 1;
+        }
+    }
+    return esq;
+}
+
+// Lê a próxima aresta "v1 v2 peso" do arquivo texto
+bool ler_aresta(FILE* arquivo, int* v1, int* v2, int* peso) {
+    return fscanf(arquivo, "%d %d %d", v1, v2, peso) == 3;
+}
+
+// Divide o grafo do arquivo de arestas em partições gravadas no diretório.
+// Cada partição cabe em um buffer de orcamento / num_buffers bytes. O orçamento
+// vale só para os buffers: o array de graus (8 bytes por vértice) é alocado à parte.
+GrafoParticionado* particionar_grafo(const char* arquivo_arestas, const char* diretorio,
+                                     int num_vertices, bool direcionado,
+                                     size_t orcamento, int num_buffers) {
+    if (num_buffers < 2 || orcamento == 0) {
+        fprintf(stderr, "Erro: são necessários pelo menos 2 buffers e um orçamento de memória positivo.\n");
+        exit(EXIT_FAILURE);
+    }
+    GrafoParticionado* g = (GrafoParticionado*)malloc(sizeof(GrafoParticionado));
+    int64_t* grau = (int64_t*)calloc(num_vertices, sizeof(int64_t));
+    if (g == NULL || grau == NULL) {
+        perror("Erro ao alocar memória para o grafo particionado");
+        exit(EXIT_FAILURE);
+    }
+    g->num_vertices = num_vertices;
+    g->direcionado = direcionado;
+    g->tamanho_buffer = orcamento / num_buffers;
+    snprintf(g->diretorio, sizeof(g->diretorio), "%s", diretorio);
+    mkdir(diretorio, 0755);
+
+    FILE* entrada = fopen(arquivo_arestas, "r");
+    if (entrada == NULL) {
+        perror("Erro ao abrir o arquivo de arestas");
+        exit(EXIT_FAILURE);
+    }
+
+    // Primeira passada: conta o grau de saída de cada vértice
+    int v1, v2, peso;
+    long invalidas = 0;
+    while (ler_aresta(entrada, &v1, &v2, &peso)) {
+        if (v1 < 0 || v1 >= num_vertices || v2 < 0 || v2 >= num_vertices) {
+            invalidas++;
+            continue;
+        }
+        grau[v1]++;
+        if (!direcionado && v1 != v2) {
+            grau[v2]++;
+        }
+    }
+    if (invalidas > 0) {
+        fprintf(stderr, "Aviso: %ld aresta(s) fora dos limites do grafo descartada(s).\n", invalidas);
+    }
+
+    // Define as faixas de vértices de forma gulosa, respeitando o tamanho do buffer.
+    // Os arrays crescem conforme as partições são criadas, e não por vértice.
+    int capacidade = 16;
+    g->limites = (int*)malloc((capacidade + 1) * sizeof(int));
+    g->tamanhos = (size_t*)malloc(capacidade * sizeof(size_t));
+    if (g->limites == NULL || g->tamanhos == NULL) {
+        perror("Erro ao alocar memória para as partições");
+        exit(EXIT_FAILURE);
+    }
+    size_t base = sizeof(CabecalhoParticao) + sizeof(int64_t);
+    size_t tamanho = base;
+    g->num_particoes = 0;
+    g->limites[0] = 0;
+    for (int v = 0; v <= num_vertices; v++) {
+        size_t custo = 0;
+        if (v < num_vertices) {
+            custo = sizeof(int64_t) + (size_t)grau[v] * (2 * sizeof(int32_t));
+            if (base + custo > g->tamanho_buffer) {
+                fprintf(stderr, "Erro: o vértice %d não cabe em um buffer de %zu bytes.\n", v, g->tamanho_buffer);
+                exit(EXIT_FAILURE);
+            }
+        }
+        // Fecha a partição atual quando o vértice não cabe mais ou quando os vértices acabam
+        if (v == num_vertices || tamanho + custo > g->tamanho_buffer) {
+            if (g->num_particoes == capacidade) {
+                capacidade *= 2;
+                int* limites = (int*)realloc(g->limites, (capacidade + 1) * sizeof(int));
+                size_t* tamanhos = (size_t*)realloc(g->tamanhos, capacidade * sizeof(size_t));
+                if (limites == NULL || tamanhos == NULL) {
+                    perror("Erro ao alocar memória para as partições");
+                    exit(EXIT_FAILURE);
+                }
+                g->limites = limites;
+                g->tamanhos = tamanhos;
+            }
+            g->tamanhos[g->num_particoes] = tamanho;
+            g->limites[++g->num_particoes] = v;
+            tamanho = base;
+        }
+        tamanho += custo;
+    }
+
+    // Segunda passada: espalha as arestas em um arquivo temporário por partição.
+    // Para não estourar o limite de arquivos abertos, cada leitura da entrada só
+    // atende um grupo de partições (até MAX_ARQUIVOS_ABERTOS ou metade do limite do sistema).
+    FILE* temporarios[MAX_ARQUIVOS_ABERTOS];
+    long limite_sistema = sysconf(_SC_OPEN_MAX);
+    int tam_grupo = MAX_ARQUIVOS_ABERTOS;
+    if (limite_sistema > 0 && limite_sistema / 2 < tam_grupo) {
+        tam_grupo = limite_sistema / 2 > 1 ? (int)(limite_sistema / 2) : 1;
+    }
+    char caminho[TAM_CAMINHO];
+    for (int grupo = 0; grupo < g->num_particoes; grupo += tam_grupo) {
+        int fim_grupo = grupo + tam_grupo < g->num_particoes ? grupo + tam_grupo : g->num_particoes;
+        for (int p = grupo; p < fim_grupo; p++) {
+            caminho_particao(g, p, "tmp", caminho);
+            temporarios[p - grupo] = fopen(caminho, "wb");
+            if (temporarios[p - grupo] == NULL) {
+                perror("Erro ao criar arquivo temporário da partição");
+                exit(EXIT_FAILURE);
+            }
+        }
+        rewind(entrada);
+        while (ler_aresta(entrada, &v1, &v2, &peso)) {
+            if (v1 < 0 || v1 >= num_vertices || v2 < 0 || v2 >= num_vertices) continue;
+            int p1 = particao_de(g, v1);
+            if (p1 >= grupo && p1 < fim_grupo) {
+                int32_t aresta[3] = {v1, v2, peso};
+                if (fwrite(aresta, sizeof(aresta), 1, temporarios[p1 - grupo]) != 1) {
+                    perror("Erro ao gravar arquivo temporário da partição");
+                    exit(EXIT_FAILURE);
+                }
+            }
+            if (direcionado || v1 == v2) continue;
+            int p2 = particao_de(g, v2);
+            if (p2 >= grupo && p2 < fim_grupo) {
+                int32_t espelho[3] = {v2, v1, peso};
+                if (fwrite(espelho, sizeof(espelho), 1, temporarios[p2 - grupo]) != 1) {
+                    perror("Erro ao gravar arquivo temporário da partição");
+                    exit(EXIT_FAILURE);
+                }
+            }
+        }
+        for (int p = grupo; p < fim_grupo; p++) {
+            if (fclose(temporarios[p - grupo]) != 0) {
+                perror("Erro ao gravar arquivo temporário da partição");
+                exit(EXIT_FAILURE);
+            }
+        }
+    }
+    fclose(entrada);
+
+    // Monta cada partição em memória (cabe em um buffer) e grava no disco
+    char* memoria = (char*)malloc(g->tamanho_buffer);
+    if (memoria == NULL) {
+        perror("Erro ao alocar memória para montar as partições");
+        exit(EXIT_FAILURE);
+    }
+    for (int p = 0; p < g->num_particoes; p++) {
+        int inicio = g->limites[p];
+        int fim = g->limites[p + 1];
+        int n = fim - inicio;
+        CabecalhoParticao* cabecalho = (CabecalhoParticao*)memoria;
+        int64_t* deslocamentos = (int64_t*)(cabecalho + 1);
+        int64_t num_arestas = 0;
+        for (int i = 0; i < n; i++) {
+            deslocamentos[i] = num_arestas;
+            num_arestas += grau[inicio + i];
+        }
+        deslocamentos[n] = num_arestas;
+        int32_t* destinos = (int32_t*)(deslocamentos + n + 1);
+        int32_t* pesos = destinos + num_arestas;
+        cabecalho->inicio = inicio;
+        cabecalho->fim = fim;
+        cabecalho->num_arestas = num_arestas;
+
+        // O grau já foi contado, então ele é reaproveitado como cursor de escrita
+        for (int i = 0; i < n; i++) {
+            grau[inicio + i] = deslocamentos[i];
+        }
+        caminho_particao(g, p, "tmp", caminho);
+        FILE* temporario = fopen(caminho, "rb");
+        if (temporario == NULL) {
+            perror("Erro ao abrir arquivo temporário da partição");
+            exit(EXIT_FAILURE);
+        }
+        int32_t aresta[3];
+        int64_t lidas = 0;
+        while (lidas < num_arestas && fread(aresta, sizeof(aresta), 1, temporario) == 1) {
+            int64_t posicao = grau[aresta[0]]++;
+            destinos[posicao] = aresta[1];
+            pesos[posicao] = aresta[2];
+            lidas++;
+        }
+        fclose(temporario);
+        remove(caminho);
+        // Sem todas as arestas, destinos teria lixo que depois seria usado como índice
+        if (lidas != num_arestas) {
+            fprintf(stderr, "Erro: a partição %d tem %lld de %lld arestas no arquivo temporário.\n",
+                    p, (long long)lidas, (long long)num_arestas);
+            exit(EXIT_FAILURE);
+        }
+
+        caminho_particao(g, p, "bin", caminho);
+        FILE* saida = fopen(caminho, "wb");
+        if (saida == NULL || fwrite(memoria, g->tamanhos[p], 1, saida) != 1 || fclose(saida) != 0) {
+            perror("Erro ao gravar a partição");
+            exit(EXIT_FAILURE);
+        }
+    }
+    free(memoria);
+    free(grau);
+
+    return g;
+}
+
+// Lê a partição p do disco para o buffer (chamada com a trava liberada)
+void ler_particao(PoolBuffers* pool, Buffer* b, int p) {
+    char caminho[TAM_CAMINHO];
+    caminho_particao(pool->g, p, "bin", caminho);
+    FILE* arquivo = fopen(caminho, "rb");
+    if (arquivo == NULL || fread(b->memoria, pool->g->tamanhos[p], 1, arquivo) != 1) {
+        perror("Erro ao ler a partição");
+        exit(EXIT_FAILURE);
+    }
+    fclose(arquivo);
+
+    CabecalhoParticao* cabecalho = (CabecalhoParticao*)b->memoria;
+    b->inicio = cabecalho->inicio;
+    b->fim = cabecalho->fim;
+    b->deslocamentos = (int64_t*)(cabecalho + 1);
+    b->destinos = (int32_t*)(b->deslocamentos + (b->fim - b->inicio) + 1);
+    b->pesos = b->destinos + cabecalho->num_arestas;
+}
+
+// Procura o buffer que contém (ou está carregando) a partição p
+Buffer* buffer_da_particao(PoolBuffers* pool, int p) {
+    for (int i = 0; i < pool->num_buffers; i++) {
+        if (pool->buffers[i].estado != BUFFER_VAZIO && pool->buffers[i].particao == p) {
+            return &pool->buffers[i];
+        }
+    }
+    return NULL;
+}
+
+// Escolhe o buffer a ser substituído: vazio ou o menos usado recentemente e não fixado
+Buffer* escolher_buffer(PoolBuffers* pool) {
+    Buffer* escolhido = NULL;
+    for (int i = 0; i < pool->num_buffers; i++) {
+        Buffer* b = &pool->buffers[i];
+        if (b->estado == BUFFER_CARREGANDO || b->fixado > 0) continue;
+        if (b->estado == BUFFER_VAZIO) return b;
+        if (escolhido == NULL || b->ultimo_uso < escolhido->ultimo_uso) {
+            escolhido = b;
+        }
+    }
+    return escolhido;
+}
+
+// Carrega a partição p no buffer b (chamada e retorna com a trava adquirida)
+void carregar_buffer(PoolBuffers* pool, Buffer* b, int p) {
+    b->particao = p;
+    b->estado = BUFFER_CARREGANDO;
+    b->fixado = 0;
+    pthread_mutex_unlock(&pool->trava);
+
+    ler_particao(pool, b, p);
+
+    pthread_mutex_lock(&pool->trava);
+    b->estado = BUFFER_PRONTO;
+    b->ultimo_uso = ++pool->relogio;
+    pool->leituras++;
+    pthread_cond_broadcast(&pool->mudou);
+}
+
+// Thread que atende os pedidos de carregamento antecipado
+void* thread_prefetch(void* arg) {
+    PoolBuffers* pool = (PoolBuffers*)arg;
+    pthread_mutex_lock(&pool->trava);
+    while (true) {
+        while (!pool->encerrar && pool->pedido == -1) {
+            pthread_cond_wait(&pool->mudou, &pool->trava);
+        }
+        if (pool->encerrar) break;
+
+        int p = pool->pedido;
+        pool->pedido = -1;
+        if (buffer_da_particao(pool, p) != NULL) continue;
+        Buffer* b = escolher_buffer(pool);
+        if (b == NULL) continue; // Todos os buffers ocupados: descarta o pedido
+        carregar_buffer(pool, b, p);
+    }
+    pthread_mutex_unlock(&pool->trava);
+    return NULL;
+}
+
+// Cria o conjunto de buffers; o total de memória usado é num_buffers * g->tamanho_buffer
+PoolBuffers* criar_pool(GrafoParticionado* g, int num_buffers) {
+    if (num_buffers < 2) {
+        fprintf(stderr, "Erro: são necessários pelo menos 2 buffers.\n");
+        exit(EXIT_FAILURE);
+    }
+    PoolBuffers* pool = (PoolBuffers*)malloc(sizeof(PoolBuffers));
+    if (pool == NULL) {
+        perror("Erro ao alocar memória para os buffers");
+        exit(EXIT_FAILURE);
+    }
+    pool->g = g;
+    pool->num_buffers = num_buffers;
+    pool->relogio = 0;
+    pool->pedido = -1;
+    pool->encerrar = false;
+    pool->leituras = 0;
+    pool->buffers = (Buffer*)calloc(num_buffers, sizeof(Buffer));
+    if (pool->buffers == NULL) {
+        perror("Erro ao alocar memória para os buffers");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < num_buffers; i++) {
+        pool->buffers[i].particao = -1;
+        pool->buffers[i].estado = BUFFER_VAZIO;
+        pool->buffers[i].memoria = (char*)malloc(g->tamanho_buffer);
+        if (pool->buffers[i].memoria == NULL) {
+            perror("Erro ao alocar memória para os buffers");
+            exit(EXIT_FAILURE);
+        }
+    }
+    pthread_mutex_init(&pool->trava, NULL);
+    pthread_cond_init(&pool->mudou, NULL);
+    pthread_create(&pool->thread, NULL, thread_prefetch, pool);
+    return pool;
+}
+
+// Obtém a partição p fixada em um buffer, carregando-a se ainda não estiver em memória
+Buffer* pool_obter(PoolBuffers* pool, int p) {
+    pthread_mutex_lock(&pool->trava);
+    Buffer* b = buffer_da_particao(pool, p);
+    while (b == NULL || b->estado != BUFFER_PRONTO) {
+        if (b == NULL) {
+            if (pool->pedido == p) pool->pedido = -1;
+            b = escolher_buffer(pool);
+            if (b != NULL) {
+                carregar_buffer(pool, b, p);
+                break;
+            }
+        }
+        // A partição está chegando pela thread auxiliar ou não há buffer livre
+        pthread_cond_wait(&pool->mudou, &pool->trava);
+        b = buffer_da_particao(pool, p);
+    }
+    b->fixado++;
+    b->ultimo_uso = ++pool->relogio;
+    pthread_mutex_unlock(&pool->trava);
+    return b;
+}
+
+// Libera um buffer obtido por pool_obter
+void pool_liberar(PoolBuffers* pool, Buffer* b) {
+    pthread_mutex_lock(&pool->trava);
+    b->fixado--;
+    pthread_cond_broadcast(&pool->mudou);
+    pthread_mutex_unlock(&pool->trava);
+}
+
+// Pede que a partição p seja carregada em segundo plano
+void pool_prefetch(PoolBuffers* pool, int p) {
+    pthread_mutex_lock(&pool->trava);
+    if (buffer_da_particao(pool, p) == NULL) {
+        pool->pedido = p;
+        pthread_cond_broadcast(&pool->mudou);
+    }
+    pthread_mutex_unlock(&pool->trava);
+}
+
+// Encerra a thread auxiliar e libera os buffers
+void destruir_pool(PoolBuffers* pool) {
+    pthread_mutex_lock(&pool->trava);
+    pool->encerrar = true;
+    pthread_cond_broadcast(&pool->mudou);
+    pthread_mutex_unlock(&pool->trava);
+    pthread_join(pool->thread, NULL);
+
+    for (int i = 0; i < pool->num_buffers; i++) {
+        free(pool->buffers[i].memoria);
+    }
+    free(pool->buffers);
+    pthread_mutex_destroy(&pool->trava);
+    pthread_cond_destroy(&pool->mudou);
+    free(pool);
+}
+
+// Próxima partição (depois de p, em ordem circular) que ainda tem vértices ativos
+int proxima_particao_ativa(GrafoParticionado* g, long* ativos, int p) {
+    for (int i = 1; i <= g->num_particoes; i++) {
+        int q = (p + i) % g->num_particoes;
+        if (ativos[q] > 0) return q;
+    }
+    return -1;
+}
+
+// Marca em alcancado todos os vértices alcançáveis a partir da origem.
+// As partições são varridas em ordem e só as que têm vértices ativos são lidas.
+// Dentro da partição carregada a busca segue por uma fila local; ativo e ativos
+// só guardam os vértices que esperam por outra partição.
+// Retorna a quantidade de vértices alcançados.
+int alcancaveis(GrafoParticionado* g, PoolBuffers* pool, int origem, bool* alcancado) {
+    int maior_particao = 0;
+    for (int p = 0; p < g->num_particoes; p++) {
+        if (g->limites[p + 1] - g->limites[p] > maior_particao) {
+            maior_particao = g->limites[p + 1] - g->limites[p];
+        }
+    }
+    bool* ativo = (bool*)calloc(g->num_vertices, sizeof(bool));
+    long* ativos = (long*)calloc(g->num_particoes, sizeof(long)); // Vértices ativos por partição
+    int* fila = (int*)malloc(maior_particao * sizeof(int));
+    if (ativo == NULL || ativos == NULL || fila == NULL) {
+        perror("Erro ao alocar memória para a busca");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < g->num_vertices; i++) {
+        alcancado[i] = false;
+    }
+
+    alcancado[origem] = true;
+    ativo[origem] = true;
+    int p = particao_de(g, origem);
+    ativos[p] = 1;
+    int total = 1;
+
+    while (p != -1) {
+        Buffer* b = pool_obter(pool, p);
+        int proxima = proxima_particao_ativa(g, ativos, p);
+        if (proxima != -1 && proxima != p) {
+            pool_prefetch(pool, proxima);
+        }
+
+        // Passa os vértices ativos da partição para a fila local
+        int frente = 0, tras = 0;
+        for (int v = b->inicio; v < b->fim && tras < ativos[p]; v++) {
+            if (ativo[v]) {
+                ativo[v] = false;
+                fila[tras++] = v;
+            }
+        }
+        ativos[p] = 0;
+
+        // Esvazia a fila; cada vértice da partição entra nela no máximo uma vez
+        while (frente < tras) {
+            int v = fila[frente++];
+            for (int64_t k = b->deslocamentos[v - b->inicio]; k < b->deslocamentos[v - b->inicio + 1]; k++) {
+                int w = b->destinos[k];
+                if (alcancado[w]) continue;
+                alcancado[w] = true;
+                total++;
+                if (w >= b->inicio && w < b->fim) {
+                    fila[tras++] = w;
+                } else {
+                    ativo[w] = true;
+                    ativos[particao_de(g, w)]++;
+                }
+            }
+        }
+
+        pool_liberar(pool, b);
+        p = proxima_particao_ativa(g, ativos, p);
+    }
+
+    free(ativo);
+    free(ativos);
+    free(fila);
+    return total;
+}
+
+// Encontra a raiz do conjunto de v (com compressão de caminho pela metade)
+int encontrar(int* pai, int v) {
+    while (pai[v] != v) {
+        pai[v] = pai[pai[v]];
+        v = pai[v];
+    }
+    return v;
+}
+
+// Calcula as componentes conexas (fracamente conexas, se o grafo for direcionado)
+// em uma única varredura pelas partições. Cada vértice recebe como rótulo o menor
+// vértice de sua componente. Retorna a quantidade de componentes.
+int componentes_conexas(GrafoParticionado* g, PoolBuffers* pool, int* componente) {
+    for (int v = 0; v < g->num_vertices; v++) {
+        componente[v] = v;
+    }
+
+    for (int p = 0; p < g->num_particoes; p++) {
+        Buffer* b = pool_obter(pool, p);
+        if (p + 1 < g->num_particoes) {
+            pool_prefetch(pool, p + 1);
+        }
+        for (int v = b->inicio; v < b->fim; v++) {
+            for (int64_t k = b->deslocamentos[v - b->inicio]; k < b->deslocamentos[v - b->inicio + 1]; k++) {
+                int r1 = encontrar(componente, v);
+                int r2 = encontrar(componente, b->destinos[k]);
+                // A raiz de maior índice aponta para a de menor, mantendo o menor vértice como rótulo
+                if (r1 < r2) {
+                    componente[r2] = r1;
+                } else if (r2 < r1) {
+                    componente[r1] = r2;
+                }
+            }
+        }
+        pool_liberar(pool, b);
+    }
+
+    int num_componentes = 0;
+    for (int v = 0; v < g->num_vertices; v++) {
+        componente[v] = encontrar(componente, v);
+        if (componente[v] == v) num_componentes++;
+    }
+    return num_componentes;
+}
+
+// Remove os arquivos e o diretório das partições e libera o grafo
+void destruir_grafo_particionado(GrafoParticionado* g) {
+    char caminho[TAM_CAMINHO];
+    for (int p = 0; p < g->num_particoes; p++) {
+        caminho_particao(g, p, "bin", caminho);
+        remove(caminho);
+    }
+    rmdir(g->diretorio);
+    free(g->limites);
+    free(g->tamanhos);
+    free(g);
+}
+
+// Imprime as faixas de vértices de cada partição
+void imprimir_particoes(GrafoParticionado* g) {
+    printf("Particoes (buffer de %zu bytes):\n", g->tamanho_buffer);
+    for (int p = 0; p < g->num_particoes; p++) {
+        printf("%d: vertices %d a %d, %zu bytes\n", p, g->limites[p], g->limites[p + 1] - 1, g->tamanhos[p]);
+    }
+}
+
+// Exemplo de uso:
+//   ./grafo_particionado                         (grafo de exemplo)
+//   ./grafo_particionado arestas.txt num_vertices direcionado(0/1) orcamento_bytes num_buffers origem
+//   (orcamento_bytes limita só os buffers; os arrays por vértice são alocados à parte)
+int main(int argc, char* argv[]) {
+    const char* arquivo = "arestas_exemplo.txt";
+    int num_vertices = 8;
+    bool direcionado = false;
+    size_t orcamento = 2 * 96; // Pequeno de propósito, para forçar várias partições
+    int num_buffers = 2;
+    int origem = 0;
+
+    if (argc == 7) {
+        arquivo = argv[1];
+        num_vertices = atoi(argv[2]);
+        direcionado = atoi(argv[3]) != 0;
+        orcamento = (size_t)strtoull(argv[4], NULL, 10);
+        num_buffers = atoi(argv[5]);
+        origem = atoi(argv[6]);
+    } else {
+        // Duas componentes: {0, 1, 2, 3, 4} e {5, 6, 7}
+        FILE* exemplo = fopen(arquivo, "w");
+        if (exemplo == NULL) {
+            perror("Erro ao criar o arquivo de exemplo");
+            return 1;
+        }
+        fprintf(exemplo, "0 1 1\n0 2 2\n1 3 3\n2 3 4\n3 4 5\n5 6 1\n6 7 1\n");
+        fclose(exemplo);
+    }
+    if (origem < 0 || origem >= num_vertices) {
+        printf("Vertice de origem invalido!\n");
+        return 1;
+    }
+
+    GrafoParticionado* g = particionar_grafo(arquivo, "particoes", num_vertices, direcionado,
+                                             orcamento, num_buffers);
+    imprimir_particoes(g);
+    PoolBuffers* pool = criar_pool(g, num_buffers);
+
+    // Alcançabilidade a partir da origem
+    bool* alcancado = (bool*)malloc(num_vertices * sizeof(bool));
+    int* componente = (int*)malloc(num_vertices * sizeof(int));
+    if (alcancado == NULL || componente == NULL) {
+        perror("Erro ao alocar memória para os resultados");
+        return 1;
+    }
+    int total = alcancaveis(g, pool, origem, alcancado);
+    printf("\nVertices alcancaveis a partir de %d: %d\n", origem, total);
+    if (num_vertices <= 100) {
+        for (int v = 0; v < num_vertices; v++) {
+            if (alcancado[v]) printf("%d ", v);
+        }
+        printf("\n");
+    }
+
+    // Componentes conexas
+    int num_componentes = componentes_conexas(g, pool, componente);
+    printf("\nComponentes conexas: %d\n", num_componentes);
+    if (num_vertices <= 100) {
+        for (int v = 0; v < num_vertices; v++) {
+            printf("%d: componente %d\n", v, componente[v]);
+        }
+    }
+    printf("\nParticoes lidas do disco: %ld\n", pool->leituras);
+
+    // Liberando memória
+    free(alcancado);
+    free(componente);
+    destruir_pool(pool);
+    destruir_grafo_particionado(g);
+    if (argc != 7) remove(arquivo);
+
+    return 0;
+}
\ No newline at end of file